@@ -0,0 +1,7 @@
+#!/bin/bash
+
+$(root-config --cxx) $(root-config --cflags) \
+                     -O2 -Wall -pthread \
+		     -o chain-analyze.exe \
+		     -DMAIN_PROGRAM ChainAnalyze.C \
+		     $(root-config --libs)
@@ -0,0 +1,7 @@
+#!/bin/bash
+
+$(root-config --cxx) $(root-config --cflags) \
+                     -O2 -Wall \
+		     -o bench.exe \
+		     -DMAIN_PROGRAM BenchmarkMCMC.C \
+		     $(root-config --libs)
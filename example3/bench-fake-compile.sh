@@ -0,0 +1,7 @@
+#!/bin/bash
+
+$(root-config --cxx) $(root-config --cflags) \
+		     -O2 -Wall -pthread \
+		     -DMAIN_PROGRAM BenchmarkFake.C \
+		     $(root-config --libs) \
+		     -o bench-fake.exe
@@ -1,6 +1,7 @@
 #!/bin/bash
 
 $(root-config --cxx) $(root-config --cflags) \
+		     -pthread \
 		     -DMAIN_PROGRAM FakeMCMC.C \
 		     $(root-config --libs) \
 		     -o fake-mcmc.exe
@@ -0,0 +1,7 @@
+#!/bin/bash
+
+$(root-config --cxx) $(root-config --cflags) \
+                     -O2 -Wall -pthread \
+		     -o parallel.exe \
+		     -DMAIN_PROGRAM ParallelMCMC.C \
+		     $(root-config --libs)